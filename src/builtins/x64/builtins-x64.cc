@@ -1136,16 +1136,22 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ bind(&ok);
 
     // If ok, push undefined as the initial value for all register file entries.
+    // The loop pushes two registers per iteration, so push the odd one out
+    // first.
     Label loop_header;
     Label loop_check;
     __ LoadRoot(rax, RootIndex::kUndefinedValue);
+    __ testl(rcx, Immediate(kSystemPointerSize));
+    __ j(zero, &loop_check, Label::kNear);
+    __ Push(rax);
+    __ subq(rcx, Immediate(kSystemPointerSize));
     __ j(always, &loop_check, Label::kNear);
     __ bind(&loop_header);
-    // TODO(rmcilroy): Consider doing more than one push per loop iteration.
+    __ Push(rax);
     __ Push(rax);
     // Continue loop if not done.
     __ bind(&loop_check);
-    __ subq(rcx, Immediate(kSystemPointerSize));
+    __ subq(rcx, Immediate(2 * kSystemPointerSize));
     __ j(greater_equal, &loop_header, Label::kNear);
   }
 
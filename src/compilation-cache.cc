@@ -148,6 +148,11 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheScript::Lookup(
       if (HasOrigin(function_info, name, line_offset, column_offset,
                     resource_options)) {
         result = scope.CloseAndEscape(function_info);
+      } else {
+        isolate()
+            ->counters()
+            ->compilation_cache_script_origin_mismatches()
+            ->Increment();
       }
     }
   }
@@ -164,9 +169,11 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheScript::Lookup(
                      resource_options));
 #endif
     isolate()->counters()->compilation_cache_hits()->Increment();
+    isolate()->counters()->compilation_cache_script_hits()->Increment();
     LOG(isolate(), CompilationCacheEvent("hit", "script", *function_info));
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    isolate()->counters()->compilation_cache_script_misses()->Increment();
   }
   return result;
 }
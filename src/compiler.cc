@@ -605,6 +605,91 @@ bool FinalizeUnoptimizedCode(
   return true;
 }
 
+// Each native context holds a small cache of OSR code, so that re-entering a
+// hot loop (e.g. on a later invocation of the same function) can reuse the
+// code instead of recompiling it. Optimized code is specialized to its
+// feedback vector, so entries are keyed on the vector and the OSR offset.
+// Code that also folds in the function context is keyed on that context.
+constexpr int kOsrCodeCacheFeedbackVectorOffset =
+    Compiler::kOsrCodeCacheFeedbackVectorOffset;
+constexpr int kOsrCodeCacheContextOffset = Compiler::kOsrCodeCacheContextOffset;
+constexpr int kOsrCodeCacheCodeOffset = Compiler::kOsrCodeCacheCodeOffset;
+constexpr int kOsrCodeCacheOsrOffsetOffset =
+    Compiler::kOsrCodeCacheOsrOffsetOffset;
+constexpr int kOsrCodeCacheEntryLength = Compiler::kOsrCodeCacheEntryLength;
+constexpr int kOsrCodeCacheMaxEntries = 16;
+
+bool IsLiveOsrCodeCacheEntry(WeakFixedArray cache, int entry) {
+  HeapObject code;
+  return cache->Get(entry + kOsrCodeCacheFeedbackVectorOffset)->IsWeak() &&
+         !cache->Get(entry + kOsrCodeCacheContextOffset)->IsCleared() &&
+         cache->Get(entry + kOsrCodeCacheCodeOffset)
+             ->GetHeapObjectIfWeak(&code) &&
+         !Code::cast(code)->marked_for_deoptimization();
+}
+
+Code GetCodeFromOsrCodeCache(JSFunction function, BailoutId osr_offset) {
+  WeakFixedArray cache = function->native_context()->osr_code_cache();
+  for (int entry = 0; entry < cache->length();
+       entry += kOsrCodeCacheEntryLength) {
+    if (!IsLiveOsrCodeCacheEntry(cache, entry)) continue;
+    if (cache->Get(entry + kOsrCodeCacheFeedbackVectorOffset)
+            ->GetHeapObjectAssumeWeak() != function->feedback_vector()) {
+      continue;
+    }
+    if (cache->Get(entry + kOsrCodeCacheOsrOffsetOffset)->ToSmi()->value() !=
+        osr_offset.ToInt()) {
+      continue;
+    }
+    MaybeObject context = cache->Get(entry + kOsrCodeCacheContextOffset);
+    if (context->IsWeak() &&
+        context->GetHeapObjectAssumeWeak() != function->context()) {
+      continue;
+    }
+    return Code::cast(
+        cache->Get(entry + kOsrCodeCacheCodeOffset)->GetHeapObjectAssumeWeak());
+  }
+  return Code();
+}
+
+// Inserts OSR {code} for {function}. If the code was specialized to the
+// function context, the entry only matches closures with that context.
+void InsertCodeIntoOsrCodeCache(Handle<JSFunction> function,
+                                Handle<Code> code, BailoutId osr_offset,
+                                bool is_function_context_specializing) {
+  Isolate* isolate = function->GetIsolate();
+  Handle<Context> native_context(function->native_context(), isolate);
+  Handle<WeakFixedArray> cache(native_context->osr_code_cache(), isolate);
+  int entry = 0;
+  // Reuse the first entry whose code, feedback vector or context died, or
+  // whose code got deoptimized.
+  while (entry < cache->length() && IsLiveOsrCodeCacheEntry(*cache, entry)) {
+    entry += kOsrCodeCacheEntryLength;
+  }
+  if (entry == cache->length()) {
+    if (entry < kOsrCodeCacheMaxEntries * kOsrCodeCacheEntryLength) {
+      cache = isolate->factory()->CopyWeakFixedArrayAndGrow(
+          cache, kOsrCodeCacheEntryLength, AllocationType::kOld);
+      native_context->set_osr_code_cache(*cache);
+    } else {
+      // The cache is full, evict the oldest entry.
+      for (int i = kOsrCodeCacheEntryLength; i < cache->length(); i++) {
+        cache->Set(i - kOsrCodeCacheEntryLength, cache->Get(i));
+      }
+      entry -= kOsrCodeCacheEntryLength;
+    }
+  }
+  cache->Set(entry + kOsrCodeCacheFeedbackVectorOffset,
+             HeapObjectReference::Weak(function->feedback_vector()));
+  cache->Set(entry + kOsrCodeCacheContextOffset,
+             is_function_context_specializing
+                 ? HeapObjectReference::Weak(function->context())
+                 : MaybeObject::FromSmi(Smi::zero()));
+  cache->Set(entry + kOsrCodeCacheCodeOffset, HeapObjectReference::Weak(*code));
+  cache->Set(entry + kOsrCodeCacheOsrOffsetOffset,
+             MaybeObject::FromSmi(Smi::FromInt(osr_offset.ToInt())));
+}
+
 V8_WARN_UNUSED_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeCache(
     Handle<JSFunction> function, BailoutId osr_offset) {
   RuntimeCallTimerScope runtimeTimer(
@@ -626,6 +711,9 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeCache(
         return Handle<Code>(code, feedback_vector->GetIsolate());
       }
     }
+  } else if (function->has_feedback_vector()) {
+    Code code = GetCodeFromOsrCodeCache(*function, osr_offset);
+    if (!code.is_null()) return Handle<Code>(code, function->GetIsolate());
   }
   return MaybeHandle<Code>();
 }
@@ -644,6 +732,15 @@ void InsertCodeIntoOptimizedCodeCache(
   Handle<Code> code = compilation_info->code();
   if (code->kind() != Code::OPTIMIZED_FUNCTION) return;  // Nothing to do.
 
+  // OSR code is cached per native context, keyed on the function context if
+  // it was folded in.
+  if (!compilation_info->osr_offset().IsNone()) {
+    InsertCodeIntoOsrCodeCache(
+        compilation_info->closure(), code, compilation_info->osr_offset(),
+        compilation_info->is_function_context_specializing());
+    return;
+  }
+
   // Function context specialization folds-in the function context,
   // so no sharing can occur.
   if (compilation_info->is_function_context_specializing()) {
@@ -1243,6 +1340,12 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
     return true;
   }
 
+  // Only bytecode flushing drops the function literal id.
+  if (shared_info->HasUncompiledData() &&
+      !shared_info->uncompiled_data()->has_function_literal_id()) {
+    isolate->counters()->bytecode_recompiled()->Increment();
+  }
+
   if (shared_info->HasUncompiledDataWithPreparseData()) {
     parse_info.set_consumed_preparse_data(ConsumedPreparseData::For(
         isolate,
@@ -180,6 +180,15 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   V8_WARN_UNUSED_RESULT static MaybeHandle<Code> GetOptimizedCodeForOSR(
       Handle<JSFunction> function, BailoutId osr_offset,
       JavaScriptFrame* osr_frame);
+
+  // Layout of the entries in the native context's OSR code cache. The context
+  // slot holds the function context that the code was specialized to, or
+  // Smi zero if the code is not context specialized.
+  static const int kOsrCodeCacheFeedbackVectorOffset = 0;
+  static const int kOsrCodeCacheContextOffset = 1;
+  static const int kOsrCodeCacheCodeOffset = 2;
+  static const int kOsrCodeCacheOsrOffsetOffset = 3;
+  static const int kOsrCodeCacheEntryLength = 4;
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
@@ -382,9 +382,11 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  // in an empirical way. The AVX forms of the floating point operations have
+  // the same latencies as their SSE counterparts; only the encoding differs.
   switch (instr->arch_opcode()) {
     case kSSEFloat64Mul:
+    case kAVXFloat64Mul:
       return 5;
     case kX64Imul:
     case kX64Imul32:
@@ -402,8 +404,19 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Min:
     case kSSEFloat64Abs:
     case kSSEFloat64Neg:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Abs:
+    case kAVXFloat32Neg:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Abs:
+    case kAVXFloat64Neg:
       return 3;
     case kSSEFloat32Mul:
+    case kAVXFloat32Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -423,6 +436,8 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
       return 26;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
       return 13;
@@ -435,6 +450,24 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
       return 50;
     case kArchTruncateDoubleToI:
       return 6;
+    case kX64Movl:
+    case kX64Movq:
+    case kX64MovqDecompressTaggedSigned:
+    case kX64MovqDecompressTaggedPointer:
+    case kX64MovqDecompressAnyTagged:
+    case kX64Movdqu:
+      // Loads which hit in the L1 cache. Register to register moves and
+      // stores don't produce a value the scheduler has to wait for.
+      if (instr->HasOutput() && instr->addressing_mode() != kMode_None) {
+        return 4;
+      }
+      return 1;
+    case kX64Movsd:
+    case kX64Movss:
+      if (instr->HasOutput() && instr->addressing_mode() != kMode_None) {
+        return 5;
+      }
+      return 1;
     default:
       return 1;
   }
@@ -37,6 +37,8 @@ Reduction BranchElimination::Reduce(Node* node) {
       return ReduceLoop(node);
     case IrOpcode::kBranch:
       return ReduceBranch(node);
+    case IrOpcode::kCheckBounds:
+      return ReduceCheckBounds(node);
     case IrOpcode::kIfFalse:
       return ReduceIf(node, false);
     case IrOpcode::kIfTrue:
@@ -90,6 +92,84 @@ Reduction BranchElimination::ReduceBranch(Node* node) {
   return TakeConditionsFromFirstControl(node);
 }
 
+Reduction BranchElimination::ReduceCheckBounds(Node* node) {
+  // Bounds checks inside counted loops of the form
+  //
+  //   for (let i = 0; i < a.length; ++i) a[i]
+  //
+  // are dominated by the loop condition, which already guarantees that the
+  // non-negative {index} is below {length}. The typer cannot prove this on
+  // its own, since {length} is not a constant, so we look for the dominating
+  // comparison on the control path instead.
+  Node* index = NodeProperties::GetValueInput(node, 0);
+  Node* length = NodeProperties::GetValueInput(node, 1);
+  Node* control = NodeProperties::GetControlInput(node);
+  if (!reduced_.Get(control)) return NoChange();
+  if (!NodeProperties::IsTyped(node) || !NodeProperties::IsTyped(index) ||
+      !NodeProperties::IsTyped(length)) {
+    return NoChange();
+  }
+  // The {index} must not need any conversion (i.e. no -0 or fractional
+  // values, which would make the CheckBounds deoptimize) and must be known
+  // to be non-negative. The {length} must be in the range that the lowered
+  // CheckBounds assumes.
+  if (!NodeProperties::GetType(index).Is(Type::Unsigned32()) ||
+      !NodeProperties::GetType(length).Is(Type::Unsigned31())) {
+    return NoChange();
+  }
+
+  ControlPathConditions conditions = node_conditions_.Get(control);
+  for (BranchCondition element : conditions) {
+    Node* const condition = element.condition;
+    bool index_below_length = false;
+    switch (condition->opcode()) {
+      case IrOpcode::kNumberLessThan:
+      case IrOpcode::kSpeculativeNumberLessThan:
+        // index < length
+        index_below_length = element.is_true &&
+                             condition->InputAt(0) == index &&
+                             condition->InputAt(1) == length;
+        break;
+      case IrOpcode::kNumberLessThanOrEqual:
+      case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+        // !(length <= index)
+        index_below_length = !element.is_true &&
+                             condition->InputAt(0) == length &&
+                             condition->InputAt(1) == index;
+        break;
+      default:
+        break;
+    }
+    if (!index_below_length) continue;
+
+    // The dominating comparison now acts as the bounds check, so mark it as
+    // a critical safety check, like the deopt the CheckBounds lowers to, to
+    // keep it poisoned.
+    Node* const branch = element.branch;
+    if (!branch->IsDead() && branch->opcode() != IrOpcode::kDead) {
+      IsSafetyCheck branch_safety = IsSafetyCheckOf(branch->op());
+      IsSafetyCheck combined_safety = CombineSafetyChecks(
+          branch_safety, IsSafetyCheck::kCriticalSafetyCheck);
+      if (branch_safety != combined_safety) {
+        NodeProperties::ChangeOp(
+            branch, common()->MarkAsSafetyCheck(branch->op(), combined_safety));
+      }
+    }
+
+    // Turn the {node} into a TypeGuard, so that users still see the narrowed
+    // index type computed for the CheckBounds.
+    Node* effect = NodeProperties::GetEffectInput(node);
+    Type const type = NodeProperties::GetType(node);
+    node->TrimInputCount(0);
+    node->AppendInput(graph()->zone(), index);
+    node->AppendInput(graph()->zone(), effect);
+    node->AppendInput(graph()->zone(), control);
+    NodeProperties::ChangeOp(node, common()->TypeGuard(type));
+    return Changed(node);
+  }
+  return NoChange();
+}
+
 Reduction BranchElimination::ReduceDeoptimizeConditional(Node* node) {
   DCHECK(node->opcode() == IrOpcode::kDeoptimizeIf ||
          node->opcode() == IrOpcode::kDeoptimizeUnless);
@@ -56,6 +56,7 @@ class V8_EXPORT_PRIVATE BranchElimination final
   };
 
   Reduction ReduceBranch(Node* node);
+  Reduction ReduceCheckBounds(Node* node);
   Reduction ReduceDeoptimizeConditional(Node* node);
   Reduction ReduceIf(Node* node, bool is_true_branch);
   Reduction ReduceLoop(Node* node);
@@ -493,6 +493,10 @@ VariableTracker::State VariableTracker::MergeInputs(Node* effect_phi) {
 
 namespace {
 
+// Loads with a non-constant index from virtual objects with at most this many
+// elements are turned into a chain of Select operations.
+constexpr int kMaxElementsForSelect = 4;
+
 int OffsetOfFieldAccess(const Operator* op) {
   DCHECK(op->opcode() == IrOpcode::kLoadField ||
          op->opcode() == IrOpcode::kStoreField);
@@ -629,52 +633,55 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
-        if (length == 1 &&
-            vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
-            current->Get(var).To(&value) &&
-            (value == nullptr ||
-             NodeProperties::GetType(value).Is(access.type))) {
+        Node* values[kMaxElementsForSelect] = {};
+        bool has_values = length > 0 && length <= kMaxElementsForSelect;
+        bool reached_fixed_point = true;
+        for (int i = 0; has_values && i < length; ++i) {
+          if (!vobject->FieldAt(OffsetOfElementAt(access, i)).To(&var) ||
+              !current->Get(var).To(&value) ||
+              (value != nullptr &&
+               !NodeProperties::GetType(value).Is(access.type))) {
+            has_values = false;
+            break;
+          }
+          // If a variable has no value, we have not reached the fixed-point
+          // yet.
+          if (value == nullptr) reached_fixed_point = false;
+          values[i] = value;
+        }
+        if (has_values && length == 1) {
           // The {object} has no elements, and we know that the LoadElement
           // {index} must be within bounds, thus it must always yield this
           // one element of {object}.
-          current->SetReplacement(value);
+          current->SetReplacement(values[0]);
           break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
+        } else if (has_values) {
+          if (!reached_fixed_point) break;
+          // The {object} has only a few elements, and the LoadElement {index}
+          // is known to be within bounds, so the LoadElement must return one
+          // of them. We can turn the LoadElement into a chain of Select
+          // operations instead (still allowing the {object} to be scalar
+          // replaced). We must however mark the elements of the {object}
+          // itself as escaping.
+          Node* select = values[length - 1];
+          for (int i = length - 2; i >= 0; --i) {
+            // The constant is cached and shared across the graph, so only
+            // type it if it is fresh.
+            Node* element_index = jsgraph->Constant(i);
             Node* check =
                 jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
+                                          index, element_index);
             NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
+            select = jsgraph->graph()->NewNode(
                 jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
+                check, values[i], select);
             NodeProperties::SetType(select, access.type);
-            current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
-            break;
           }
+          current->SetReplacement(select);
+          for (int i = 0; i < length; ++i) {
+            current->SetEscaped(values[i]);
+          }
+          break;
         }
       }
       current->SetEscaped(object);
@@ -60,6 +60,15 @@ int CollectFunctions(Node* node, Handle<JSFunction>* functions,
   return 0;
 }
 
+bool IsHotInlineCandidate(CallFrequency const& frequency, int total_size) {
+  // Call sites that are hit many times per invocation of the caller, and
+  // whose callees are fairly small, pay off even when the cumulative budget
+  // is already used up, since the call overhead dominates their cost.
+  return frequency.IsKnown() &&
+         frequency.value() >= FLAG_min_hot_inlining_frequency &&
+         total_size <= FLAG_max_inlined_bytecode_size_hot;
+}
+
 bool IsSmallInlineFunction(Handle<BytecodeArray> bytecode) {
   // Forcibly inline small functions.
   // Don't forcibly inline functions that weren't compiled yet.
@@ -161,6 +170,10 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   // invocations of the caller.
   if (candidate.frequency.IsKnown() &&
       candidate.frequency.value() < FLAG_min_inlining_frequency) {
+    TRACE(
+        "Not considering call site #%d:%s, because frequency %f is below %f\n",
+        node->id(), node->op()->mnemonic(), candidate.frequency.value(),
+        FLAG_min_inlining_frequency);
     return NoChange();
   }
 
@@ -196,13 +209,31 @@ void JSInliningHeuristic::Finalize() {
     double size_of_candidate =
         candidate.total_size * FLAG_reserve_inline_budget_scale_factor;
     int total_size = cumulative_count_ + static_cast<int>(size_of_candidate);
-    if (total_size > FLAG_max_inlined_bytecode_size_cumulative) {
-      // Try if any smaller functions are available to inline.
-      continue;
+    bool const beyond_cumulative_budget =
+        total_size > FLAG_max_inlined_bytecode_size_cumulative;
+    if (beyond_cumulative_budget) {
+      // Hot call sites with small callees may still use the absolute budget,
+      // otherwise try if any smaller functions are available to inline.
+      if (!IsHotInlineCandidate(candidate.frequency, candidate.total_size) ||
+          total_size > FLAG_max_inlined_bytecode_size_absolute) {
+        TRACE(
+            "Not inlining call site #%d:%s (size %d), because the cumulative "
+            "budget is exhausted (%d used)\n",
+            candidate.node->id(), candidate.node->op()->mnemonic(),
+            candidate.total_size, cumulative_count_);
+        continue;
+      }
     }
 
     // Make sure we don't try to inline dead candidate nodes.
     if (!candidate.node->IsDead()) {
+      if (beyond_cumulative_budget) {
+        TRACE(
+            "Inlining hot call site #%d:%s (size %d) beyond the cumulative "
+            "budget\n",
+            candidate.node->id(), candidate.node->op()->mnemonic(),
+            candidate.total_size);
+      }
       Reduction const reduction = InlineCandidate(candidate, false);
       if (reduction.Changed()) return;
     }
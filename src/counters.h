@@ -1407,6 +1407,12 @@ class RuntimeCallTimerScope {
   SC(inlined_copied_elements, V8.InlinedCopiedElements)             \
   SC(compilation_cache_hits, V8.CompilationCacheHits)               \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)           \
+  SC(compilation_cache_script_hits, V8.CompilationCacheScriptHits)  \
+  SC(compilation_cache_script_misses,                               \
+     V8.CompilationCacheScriptMisses)                               \
+  /* Script cache misses where only the script origin differed. */  \
+  SC(compilation_cache_script_origin_mismatches,                    \
+     V8.CompilationCacheScriptOriginMismatches)                     \
   /* Amount of evaled source code. */                               \
   SC(total_eval_size, V8.TotalEvalSize)                             \
   /* Amount of loaded source code. */                               \
@@ -1419,6 +1425,10 @@ class RuntimeCallTimerScope {
   SC(total_compile_size, V8.TotalCompileSize)                       \
   /* Amount of source code compiled with the full codegen. */       \
   SC(total_full_codegen_source_size, V8.TotalFullCodegenSourceSize) \
+  /* Number of functions whose bytecode was flushed. */             \
+  SC(bytecode_flushed, V8.BytecodeFlushed)                          \
+  /* Number of functions recompiled after bytecode flushing. */     \
+  SC(bytecode_recompiled, V8.BytecodeRecompiled)                    \
   /* Number of contexts created from scratch. */                    \
   SC(contexts_created_from_scratch, V8.ContextsCreatedFromScratch)  \
   /* Number of contexts created by partial snapshot. */             \
@@ -1456,6 +1466,12 @@ class RuntimeCallTimerScope {
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_secondary_hits,                                    \
+     V8.MegamorphicStubCacheSecondaryHits)                                     \
+  SC(megamorphic_load_stub_cache_probes, V8.MegamorphicLoadStubCacheProbes)    \
+  SC(megamorphic_load_stub_cache_misses, V8.MegamorphicLoadStubCacheMisses)    \
+  SC(megamorphic_store_stub_cache_probes, V8.MegamorphicStoreStubCacheProbes)  \
+  SC(megamorphic_store_stub_cache_misses, V8.MegamorphicStoreStubCacheMisses)  \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                           \
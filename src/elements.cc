@@ -5,6 +5,7 @@
 #include "src/elements.h"
 
 #include "src/arguments.h"
+#include "src/base/tsan.h"
 #include "src/conversions.h"
 #include "src/frames.h"
 #include "src/heap/factory.h"
@@ -3038,6 +3039,10 @@ class TypedElementsAccessor
       }
     }
 
+    if (sizeof(ctype) == 1) {
+      return Just(IndexOfByteValue(elements, typed_search_value, start_from,
+                                   length) >= 0);
+    }
     for (uint32_t k = start_from; k < length; ++k) {
       ctype element_k = elements->get_scalar(k);
       if (element_k == typed_search_value) return Just(true);
@@ -3089,6 +3094,10 @@ class TypedElementsAccessor
       length = elements->length();
     }
 
+    if (sizeof(ctype) == 1) {
+      return Just<int64_t>(IndexOfByteValue(elements, typed_search_value,
+                                            start_from, length));
+    }
     for (uint32_t k = start_from; k < length; ++k) {
       ctype element_k = elements->get_scalar(k);
       if (element_k == typed_search_value) return Just<int64_t>(k);
@@ -3096,6 +3105,23 @@ class TypedElementsAccessor
     return Just<int64_t>(-1);
   }
 
+  // Searches byte-sized elements with memchr, which the C library implements
+  // with vector instructions, instead of comparing one element at a time.
+  static int64_t IndexOfByteValue(BackingStore elements, ctype value,
+                                  uint32_t start_from, uint32_t length) {
+    DCHECK_EQ(1, sizeof(ctype));
+    DCHECK_LE(length, static_cast<uint32_t>(elements->length()));
+    if (start_from >= length) return -1;
+    uint8_t* data = static_cast<uint8_t*>(elements->DataPtr());
+    // See the comment in FixedTypedArray<Traits>::get_scalar.
+    TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+    void* match = memchr(data + start_from, static_cast<uint8_t>(value),
+                         length - start_from);
+    TSAN_ANNOTATE_IGNORE_READS_END;
+    if (match == nullptr) return -1;
+    return static_cast<uint8_t*>(match) - data;
+  }
+
   static Maybe<int64_t> LastIndexOfValueImpl(Handle<JSObject> receiver,
                                              Handle<Object> value,
                                              uint32_t start_from) {
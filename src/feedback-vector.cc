@@ -217,6 +217,16 @@ Handle<ClosureFeedbackCellArray> ClosureFeedbackCellArray::New(
   Handle<ClosureFeedbackCellArray> feedback_cell_array =
       factory->NewClosureFeedbackCellArray(num_feedback_cells);
 
+  // Scale the allocation budget by the size of the function, so that a single
+  // run through straight-line code (e.g. a script or module top-level, or an
+  // IIFE) never allocates a feedback vector. Only functions that loop or are
+  // called repeatedly exhaust the budget.
+  if (shared->HasBytecodeArray()) {
+    feedback_cell_array->set_interrupt_budget(
+        FLAG_budget_for_feedback_vector_allocation +
+        shared->GetBytecodeArray()->length());
+  }
+
   for (int i = 0; i < num_feedback_cells; i++) {
     Handle<FeedbackCell> cell =
         factory->NewNoClosuresCell(factory->undefined_value());
@@ -372,7 +372,8 @@ DEFINE_INT(interrupt_budget, 144 * KB,
 
 DEFINE_INT(budget_for_feedback_vector_allocation, 2 * KB,
            "The budget in amount of bytecode executed by a function before we "
-           "decide to allocate feedback vectors")
+           "decide to allocate feedback vectors, on top of the function's own "
+           "bytecode size")
 DEFINE_BOOL(lazy_feedback_allocation, false, "Allocate feedback vectors lazily")
 
 // Flags for Ignition.
@@ -506,6 +507,11 @@ DEFINE_FLOAT(reserve_inline_budget_scale_factor, 1.2,
 DEFINE_INT(max_inlined_bytecode_size_small, 30,
            "maximum size of bytecode considered for small function inlining")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
+DEFINE_INT(max_inlined_bytecode_size_hot, 120,
+           "maximum size of bytecode for a hot function to be inlined once "
+           "the cumulative budget is exhausted")
+DEFINE_FLOAT(min_hot_inlining_frequency, 10,
+             "minimum frequency for a call site to be considered hot")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
@@ -692,6 +698,15 @@ DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_tier_up)
 
 // Profiler flags.
 DEFINE_INT(frame_count, 1, "number of stack frames inspected by the profiler")
+DEFINE_INT(ticks_before_optimization, 2,
+           "the number of times we have to go through the interrupt budget "
+           "before considering this function for optimization")
+DEFINE_INT(bytecode_size_allowance_per_tick, 1200,
+           "increases the number of ticks required for optimization by "
+           "bytecode.length/X (0 means no size allowance)")
+DEFINE_INT(max_bytecode_size_for_early_opt, 90,
+           "maximum bytecode length for a function to be optimized on the "
+           "first tick")
 
 DEFINE_INT(stress_sampling_allocation_profiler, 0,
            "Enables sampling allocation profiler with X as a sample interval")
@@ -821,6 +836,10 @@ DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_BOOL(stress_flush_bytecode, false, "stress bytecode flushing")
 DEFINE_IMPLICATION(stress_flush_bytecode, flush_bytecode)
+DEFINE_INT(bytecode_old_age, 3,
+           "number of full GCs without execution after which bytecode can be "
+           "flushed (1-5)")
+DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -974,6 +993,9 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, compiler_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
+            "also post parallel compile tasks for lazy top-level functions")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, parallel_compile_tasks)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
@@ -2064,12 +2064,18 @@ void MarkCompactCollector::ClearOldBytecodeCandidates() {
   DCHECK(FLAG_flush_bytecode ||
          weak_objects_.bytecode_flushing_candidates.IsEmpty());
   SharedFunctionInfo flushing_candidate;
+  int flushed_count = 0;
+  size_t flushed_size = 0;
   while (weak_objects_.bytecode_flushing_candidates.Pop(kMainThread,
                                                         &flushing_candidate)) {
     // If the BytecodeArray is dead, flush it, which will replace the field with
     // an uncompiled data object.
-    if (!non_atomic_marking_state()->IsBlackOrGrey(
-            flushing_candidate->GetBytecodeArray())) {
+    BytecodeArray bytecode = flushing_candidate->GetBytecodeArray();
+    if (!non_atomic_marking_state()->IsBlackOrGrey(bytecode)) {
+      flushed_count++;
+      if (FLAG_trace_flush_bytecode) {
+        flushed_size += bytecode->SizeIncludingMetadata();
+      }
       FlushBytecodeFromSFI(flushing_candidate);
     }
 
@@ -2079,6 +2085,12 @@ void MarkCompactCollector::ClearOldBytecodeCandidates() {
         flushing_candidate.RawField(SharedFunctionInfo::kFunctionDataOffset);
     RecordSlot(flushing_candidate, slot, HeapObject::cast(*slot));
   }
+
+  isolate()->counters()->bytecode_flushed()->Increment(flushed_count);
+  if (FLAG_trace_flush_bytecode && flushed_count > 0) {
+    PrintIsolate(isolate(), "Flushed bytecode of %d functions (%zu KB)\n",
+                 flushed_count, flushed_size / KB);
+  }
 }
 
 void MarkCompactCollector::ClearFlushedJsFunctions() {
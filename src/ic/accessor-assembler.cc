@@ -2430,10 +2430,20 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache, Node* receiver,
                                           Node* name, Label* if_handler,
                                           TVariable<MaybeObject>* var_handler,
                                           Label* if_miss) {
-  Label try_secondary(this), miss(this);
+  Label try_secondary(this), secondary_hit(this), miss(this);
 
+  // Keep separate statistics for the load and store caches, so that thrashing
+  // in either one can be told apart.
   Counters* counters = isolate()->counters();
+  bool is_load_cache = stub_cache == isolate()->load_stub_cache();
+  StatsCounter* probes_counter =
+      is_load_cache ? counters->megamorphic_load_stub_cache_probes()
+                    : counters->megamorphic_store_stub_cache_probes();
+  StatsCounter* misses_counter =
+      is_load_cache ? counters->megamorphic_load_stub_cache_misses()
+                    : counters->megamorphic_store_stub_cache_misses();
   IncrementCounter(counters->megamorphic_stub_cache_probes(), 1);
+  IncrementCounter(probes_counter, 1);
 
   // Check that the {receiver} isn't a smi.
   GotoIf(TaggedIsSmi(receiver), &miss);
@@ -2450,12 +2460,20 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache, Node* receiver,
     // Probe the secondary table.
     Node* secondary_offset = StubCacheSecondaryOffset(name, primary_offset);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
-                           receiver_map, if_handler, var_handler, &miss);
+                           receiver_map, &secondary_hit, var_handler, &miss);
+  }
+
+  BIND(&secondary_hit);
+  {
+    // Frequent secondary hits indicate conflicts in the primary table.
+    IncrementCounter(counters->megamorphic_stub_cache_secondary_hits(), 1);
+    Goto(if_handler);
   }
 
   BIND(&miss);
   {
     IncrementCounter(counters->megamorphic_stub_cache_misses(), 1);
+    IncrementCounter(misses_counter, 1);
     Goto(if_miss);
   }
 }
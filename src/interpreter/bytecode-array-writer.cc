@@ -112,8 +112,10 @@ void BytecodeArrayWriter::WriteSwitch(BytecodeNode* node,
 void BytecodeArrayWriter::BindLabel(BytecodeLabel* label) {
   DCHECK(label->has_referrer_jump());
   size_t current_offset = bytecodes()->size();
-  // Update the jump instruction's location.
-  PatchJump(current_offset, label->jump_offset());
+  if (!MaybeElideJumpToNextBytecode(label->jump_offset())) {
+    // Update the jump instruction's location.
+    PatchJump(current_offset, label->jump_offset());
+  }
   label->bind();
   StartBasicBlock();
 }
@@ -217,6 +219,32 @@ void BytecodeArrayWriter::MaybeElideLastBytecode(Bytecode next_bytecode,
   last_bytecode_offset_ = bytecodes()->size();
 }
 
+bool BytecodeArrayWriter::MaybeElideJumpToNextBytecode(size_t jump_location) {
+  // If the last bytecode is the jump whose label is being bound, it jumps to
+  // the next bytecode and can be elided, unless we would lose its source
+  // position by doing so. The last bytecode is only tracked when
+  // non-effectful bytecodes may be elided.
+  if (!elide_noneffectful_bytecodes_ ||
+      !Bytecodes::IsForwardJump(last_bytecode_) ||
+      last_bytecode_offset_ != jump_location ||
+      last_bytecode_had_source_info_) {
+    return false;
+  }
+
+  // Cancel the constant pool reservation made when the jump was emitted.
+  OperandScale operand_scale = OperandScale::kSingle;
+  Bytecode jump_bytecode = Bytecodes::FromByte(bytecodes()->at(jump_location));
+  if (Bytecodes::IsPrefixScalingBytecode(jump_bytecode)) {
+    operand_scale = Bytecodes::PrefixBytecodeToOperandScale(jump_bytecode);
+  }
+  constant_array_builder()->DiscardReservedEntry(
+      Bytecodes::SizeOfOperand(OperandType::kUImm, operand_scale));
+
+  bytecodes()->resize(jump_location);
+  unbound_jumps_--;
+  return true;
+}
+
 void BytecodeArrayWriter::InvalidateLastBytecode() {
   last_bytecode_ = Bytecode::kIllegal;
 }
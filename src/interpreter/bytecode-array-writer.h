@@ -88,6 +88,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   void UpdateExitSeenInBlock(Bytecode bytecode);
 
   void MaybeElideLastBytecode(Bytecode next_bytecode, bool has_source_info);
+  bool MaybeElideJumpToNextBytecode(size_t jump_location);
   void InvalidateLastBytecode();
 
   void StartBasicBlock();
@@ -269,19 +269,34 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaTheHole:
       case Bytecode::kLdaConstant:
       case Bytecode::kLdaUndefined:
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
       case Bytecode::kLdaGlobal:
       case Bytecode::kLdaNamedProperty:
       case Bytecode::kLdaKeyedProperty:
       case Bytecode::kLdaContextSlot:
       case Bytecode::kLdaCurrentContextSlot:
+      case Bytecode::kLdaImmutableContextSlot:
+      case Bytecode::kLdaImmutableCurrentContextSlot:
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
+      case Bytecode::kDiv:
+      case Bytecode::kBitwiseOr:
+      case Bytecode::kBitwiseAnd:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
+      case Bytecode::kMulSmi:
+      case Bytecode::kBitwiseOrSmi:
+      case Bytecode::kBitwiseAndSmi:
       case Bytecode::kInc:
       case Bytecode::kDec:
       case Bytecode::kTypeOf:
+      case Bytecode::kCreateClosure:
+      case Bytecode::kCreateArrayLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
+      case Bytecode::kCreateObjectLiteral:
+      case Bytecode::kCreateEmptyObjectLiteral:
       case Bytecode::kCallAnyReceiver:
       case Bytecode::kCallNoFeedback:
       case Bytecode::kCallProperty:
@@ -7541,6 +7541,18 @@ Handle<Derived> BaseNameDictionary<Derived, Shape>::EnsureCapacity(
     dictionary->SetNextEnumerationIndex(PropertyDetails::kInitialIndex +
                                         length);
   }
+
+  // Dictionaries of objects used as hash maps see many additions and
+  // deletions. If only the deleted entries prevent adding n elements and a
+  // new table would not be any larger, drop them by rehashing in place instead
+  // of allocating a new table.
+  if (!dictionary->HasSufficientCapacityToAdd(n) &&
+      dictionary->NumberOfDeletedElements() > 0 &&
+      HashTableBase::ComputeCapacity(dictionary->NumberOfElements() + n) ==
+          dictionary->Capacity()) {
+    dictionary->Rehash(ReadOnlyRoots(isolate));
+    DCHECK(dictionary->HasSufficientCapacityToAdd(n));
+  }
   return HashTable<Derived, Shape>::EnsureCapacity(isolate, dictionary, n);
 }
 
@@ -7728,6 +7740,50 @@ struct EnumIndexComparator {
   Dictionary dict;
 };
 
+namespace {
+
+// Sorts the dictionary entries referenced by the first {length} elements of
+// {array} by their enumeration index. Enumeration indices are handed out
+// incrementally, so unless many properties were deleted they are dense enough
+// to place every entry directly, without a comparison sort.
+template <typename Dictionary>
+void SortByEnumerationIndex(Dictionary dictionary, FixedArray array,
+                            int length) {
+  if (length < 2) return;
+  int range =
+      dictionary->NextEnumerationIndex() - PropertyDetails::kInitialIndex;
+  if (range >= length && range <= 2 * length) {
+    std::vector<int> entries(range, -1);
+    bool dense = true;
+    for (int i = 0; i < length; i++) {
+      int entry = Smi::ToInt(array->get(i));
+      int index = dictionary->DetailsAt(entry).dictionary_index() -
+                  PropertyDetails::kInitialIndex;
+      if (index < 0 || index >= range || entries[index] != -1) {
+        dense = false;
+        break;
+      }
+      entries[index] = entry;
+    }
+    if (dense) {
+      int position = 0;
+      for (int entry : entries) {
+        if (entry != -1) array->set(position++, Smi::FromInt(entry));
+      }
+      DCHECK_EQ(length, position);
+      return;
+    }
+  }
+
+  EnumIndexComparator<Dictionary> cmp(dictionary);
+  // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
+  // store operations that are safe for concurrent marking.
+  AtomicSlot start(array->GetFirstElementAddress());
+  std::sort(start, start + length, cmp);
+}
+
+}  // namespace
+
 template <typename Derived, typename Shape>
 void BaseNameDictionary<Derived, Shape>::CopyEnumKeysTo(
     Isolate* isolate, Handle<Derived> dictionary, Handle<FixedArray> storage,
@@ -7764,11 +7820,7 @@ void BaseNameDictionary<Derived, Shape>::CopyEnumKeysTo(
   DisallowHeapAllocation no_gc;
   Derived raw_dictionary = *dictionary;
   FixedArray raw_storage = *storage;
-  EnumIndexComparator<Derived> cmp(raw_dictionary);
-  // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-  // store operations that are safe for concurrent marking.
-  AtomicSlot start(storage->GetFirstElementAddress());
-  std::sort(start, start + length, cmp);
+  SortByEnumerationIndex(raw_dictionary, raw_storage, length);
   for (int i = 0; i < length; i++) {
     int index = Smi::ToInt(raw_storage->get(i));
     raw_storage->set(i, raw_dictionary->NameAt(index));
@@ -7793,12 +7845,7 @@ Handle<FixedArray> BaseNameDictionary<Derived, Shape>::IterationIndices(
     }
 
     DCHECK_EQ(array_size, length);
-
-    EnumIndexComparator<Derived> cmp(raw_dictionary);
-    // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-    // store operations that are safe for concurrent marking.
-    AtomicSlot start(array->GetFirstElementAddress());
-    std::sort(start, start + array_size, cmp);
+    SortByEnumerationIndex(raw_dictionary, *array, array_size);
   }
   return FixedArray::ShrinkOrEmpty(isolate, array, array_size);
 }
@@ -7833,12 +7880,7 @@ void BaseNameDictionary<Derived, Shape>::CollectKeysTo(
       }
       array->set(array_size++, Smi::FromInt(i));
     }
-
-    EnumIndexComparator<Derived> cmp(raw_dictionary);
-    // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-    // store operations that are safe for concurrent marking.
-    AtomicSlot start(array->GetFirstElementAddress());
-    std::sort(start, start + array_size, cmp);
+    SortByEnumerationIndex(raw_dictionary, *array, array_size);
   }
 
   bool has_seen_symbol = false;
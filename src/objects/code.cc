@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <iomanip>
 
 #include "src/objects/code.h"
@@ -888,7 +889,11 @@ void BytecodeArray::MakeOlder() {
 }
 
 bool BytecodeArray::IsOld() const {
-  return bytecode_age() >= kIsOldBytecodeAge;
+  // The age saturates at kLastBytecodeAge, so clamp the threshold to make sure
+  // bytecode can still become old.
+  int old_age = std::max(
+      1, std::min(FLAG_bytecode_old_age, static_cast<int>(kLastBytecodeAge)));
+  return bytecode_age() >= old_age;
 }
 
 DependentCode DependentCode::GetDependentCode(Handle<HeapObject> object) {
@@ -723,8 +723,7 @@ class BytecodeArray : public FixedArrayBase {
     kAfterLastBytecodeAge,
     kFirstBytecodeAge = kNoAgeBytecodeAge,
     kLastBytecodeAge = kAfterLastBytecodeAge - 1,
-    kBytecodeAgeCount = kAfterLastBytecodeAge - kFirstBytecodeAge - 1,
-    kIsOldBytecodeAge = kSexagenarianBytecodeAge
+    kBytecodeAgeCount = kAfterLastBytecodeAge - kFirstBytecodeAge - 1
   };
 
   static constexpr int SizeFor(int length) {
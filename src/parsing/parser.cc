@@ -2351,9 +2351,13 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   // If parallel compile tasks are enabled, and the function is an eager
   // top level function, then we can pre-parse the function and parse / compile
-  // in a parallel task on a worker thread.
+  // in a parallel task on a worker thread. With
+  // --parallel-compile-tasks-for-lazy, lazy top level functions are handed off
+  // too, so that they are likely compiled by the time they are first called.
   bool should_post_parallel_task =
-      parse_lazily() && is_eager_top_level_function &&
+      parse_lazily() &&
+      (is_eager_top_level_function ||
+       (is_lazy_top_level_function && FLAG_parallel_compile_tasks_for_lazy)) &&
       FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
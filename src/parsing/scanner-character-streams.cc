@@ -605,7 +605,24 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
     }
   }
 
-  while (cursor < end && output_cursor + 1 < buffer_start_ + kBufferSize) {
+  const uint16_t* max_buffer_end = buffer_start_ + kBufferSize;
+  while (cursor < end && output_cursor + 1 < max_buffer_end) {
+    // Copy runs of ASCII characters directly, unless we are in the middle of
+    // a multi-byte sequence. Only the remaining characters need decoding.
+    if (V8_LIKELY(state == unibrow::Utf8::State::kAccept)) {
+      size_t max_length = static_cast<size_t>(
+          Min(end - cursor, (max_buffer_end - 1) - output_cursor));
+      size_t ascii_length = static_cast<size_t>(
+          String::NonAsciiStart(reinterpret_cast<const char*>(cursor),
+                                static_cast<int>(max_length)));
+      if (ascii_length > 0) {
+        CopyChars(output_cursor, cursor, ascii_length);
+        cursor += ascii_length;
+        output_cursor += ascii_length;
+        continue;
+      }
+    }
+
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (V8_LIKELY(t <= unibrow::Utf16::kMaxNonSurrogateCharCode)) {
@@ -317,25 +317,25 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
 }
 
 V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
-  int start_position = source_pos();
-
   // We won't skip behind the end of input.
   DCHECK(!IsWhiteSpaceOrLineTerminator(kEndOfInput));
 
-  // Advance as long as character is a WhiteSpace or LineTerminator.
-  while (IsWhiteSpaceOrLineTerminator(c0_)) {
-    if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
-      next().after_line_terminator = true;
-    }
-    Advance();
-  }
-
   // Return whether or not we skipped any characters.
-  if (source_pos() == start_position) {
+  if (!IsWhiteSpaceOrLineTerminator(c0_)) {
     DCHECK_NE('0', c0_);
     return Token::ILLEGAL;
   }
 
+  // Advance as long as character is a WhiteSpace or LineTerminator. The
+  // characters following c0_ are checked directly in the stream's buffer.
+  bool after_line_terminator = unibrow::IsLineTerminator(c0_);
+  AdvanceUntil([&after_line_terminator](uc32 c0) {
+    if (!IsWhiteSpaceOrLineTerminator(c0)) return true;
+    after_line_terminator |= unibrow::IsLineTerminator(c0);
+    return false;
+  });
+  if (after_line_terminator) next().after_line_terminator = true;
+
   return Token::WHITESPACE;
 }
 
@@ -247,6 +247,24 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     double ms = timer.Elapsed().InMillisecondsF();
     int length = cached_data->length();
     PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
+
+    // Report how much of the cache consists of eagerly materialized bytecode,
+    // to compare against the functions that actually run.
+    DisallowHeapAllocation no_gc;
+    int function_count = 0;
+    int compiled_count = 0;
+    int bytecode_size = 0;
+    SharedFunctionInfo::ScriptIterator iter(isolate,
+                                            Script::cast(result->script()));
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      function_count++;
+      if (!info->HasBytecodeArray()) continue;
+      compiled_count++;
+      bytecode_size += info->GetBytecodeArray()->Size();
+    }
+    PrintF("[Deserialized %d functions, %d compiled (%d bytes of bytecode)]\n",
+           function_count, compiled_count, bytecode_size);
   }
 
   bool log_code_creation =
@@ -338,7 +356,7 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
 }
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
-    Isolate* isolate, uint32_t expected_source_hash) const {
+    uint32_t expected_source_hash) const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != kMagicNumber) return MAGIC_NUMBER_MISMATCH;
@@ -409,7 +427,7 @@ SerializedCodeData SerializedCodeData::FromCachedData(
     SanityCheckResult* rejection_result) {
   DisallowHeapAllocation no_gc;
   SerializedCodeData scd(cached_data);
-  *rejection_result = scd.SanityCheck(isolate, expected_source_hash);
+  *rejection_result = scd.SanityCheck(expected_source_hash);
   if (*rejection_result != CHECK_SUCCESS) {
     cached_data->Reject();
     return SerializedCodeData(nullptr, 0);
@@ -139,8 +139,7 @@ class SerializedCodeData : public SerializedData {
     return Vector<const byte>(data_ + kHeaderSize, size_ - kHeaderSize);
   }
 
-  SanityCheckResult SanityCheck(Isolate* isolate,
-                                uint32_t expected_source_hash) const;
+  SanityCheckResult SanityCheck(uint32_t expected_source_hash) const;
 };
 
 }  // namespace internal
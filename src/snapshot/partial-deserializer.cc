@@ -67,6 +67,9 @@ void PartialDeserializer::DeserializeEmbedderFields(
   DisallowJavascriptExecution no_js(isolate());
   DisallowCompilation no_compile(isolate());
   DCHECK_NOT_NULL(embedder_fields_deserializer.callback);
+  // The payloads are handed to the embedder one at a time, so a single buffer
+  // grown to the largest payload serves all embedder fields of the context.
+  std::vector<char> buffer;
   for (int code = source()->Get(); code != kSynchronize;
        code = source()->Get()) {
     HandleScope scope(isolate());
@@ -77,13 +80,11 @@ void PartialDeserializer::DeserializeEmbedderFields(
                          isolate());
     int index = source()->GetInt();
     int size = source()->GetInt();
-    // TODO(yangguo,jgruber): Turn this into a reusable shared buffer.
-    byte* data = new byte[size];
-    source()->CopyRaw(data, size);
+    if (static_cast<size_t>(size) > buffer.size()) buffer.resize(size);
+    source()->CopyRaw(buffer.data(), size);
     embedder_fields_deserializer.callback(v8::Utils::ToLocal(obj), index,
-                                          {reinterpret_cast<char*>(data), size},
+                                          {buffer.data(), size},
                                           embedder_fields_deserializer.data);
-    delete[] data;
   }
 }
 }  // namespace internal
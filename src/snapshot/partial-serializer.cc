@@ -44,6 +44,9 @@ void PartialSerializer::Serialize(Context* o, bool include_global_proxy) {
   DCHECK(!context_->global_object()->IsUndefined());
   // Reset math random cache to get fresh random numbers.
   MathRandom::ResetContext(context_);
+  // Optimized code cannot be serialized, so drop all cached OSR code.
+  context_->native_context()->set_osr_code_cache(
+      ReadOnlyRoots(isolate()).empty_weak_fixed_array());
 
 #ifdef DEBUG
   MicrotaskQueue* microtask_queue =
@@ -115,6 +115,23 @@ void Serializer::SerializeRootObject(Object object) {
   }
 }
 
+ExternalReferenceEncoder::Value Serializer::EncodeExternalReference(
+    HeapObject host, Address addr) {
+  ExternalReferenceEncoder::Value result;
+  if (external_reference_encoder_.TryEncode(addr).To(&result)) return result;
+  // Report the object holding the unknown reference, so that embedders can
+  // tell which of their templates or accessors lacks an entry in the
+  // external references passed to the SnapshotCreator.
+  v8::base::OS::PrintError("External reference of ");
+  host->ShortPrint(stderr);
+  v8::base::OS::PrintError(" cannot be serialized.\n");
+#ifdef DEBUG
+  PrintStack();
+#endif  // DEBUG
+  // Reports the unknown reference and aborts.
+  return external_reference_encoder_.Encode(addr);
+}
+
 #ifdef DEBUG
 void Serializer::PrintStack() {
   for (const auto o : stack_) {
@@ -712,7 +729,7 @@ void Serializer::ObjectSerializer::VisitEmbeddedPointer(Code host,
 void Serializer::ObjectSerializer::VisitExternalReference(Foreign host,
                                                           Address* p) {
   auto encoded_reference =
-      serializer_->EncodeExternalReference(host->foreign_address());
+      serializer_->EncodeExternalReference(host, host->foreign_address());
   if (encoded_reference.is_from_api()) {
     sink_->Put(kApiReference, "ApiRef");
   } else {
@@ -725,7 +742,7 @@ void Serializer::ObjectSerializer::VisitExternalReference(Foreign host,
 void Serializer::ObjectSerializer::VisitExternalReference(Code host,
                                                           RelocInfo* rinfo) {
   Address target = rinfo->target_external_reference();
-  auto encoded_reference = serializer_->EncodeExternalReference(target);
+  auto encoded_reference = serializer_->EncodeExternalReference(host, target);
   if (encoded_reference.is_from_api()) {
     DCHECK(!rinfo->IsCodedSpecially());
     sink_->Put(kApiReference, "ApiRef");
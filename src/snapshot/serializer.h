@@ -220,9 +220,11 @@ class Serializer : public SerializerDeserializer {
   // Returns true if the given heap object is a bytecode handler code object.
   bool ObjectIsBytecodeHandler(HeapObject obj) const;
 
-  ExternalReferenceEncoder::Value EncodeExternalReference(Address addr) {
-    return external_reference_encoder_.Encode(addr);
-  }
+  // Encodes an external reference found in |host|. Aborts with a description
+  // of |host| if the reference is neither known to V8 nor provided by the
+  // embedder through the API.
+  ExternalReferenceEncoder::Value EncodeExternalReference(HeapObject host,
+                                                          Address addr);
 
   // GetInt reads 4 bytes at once, requiring padding at the end.
   // Use padding_offset to specify the space you want to use after padding.
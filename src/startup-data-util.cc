@@ -23,6 +23,8 @@ namespace {
 
 v8::StartupData g_natives;
 v8::StartupData g_snapshot;
+base::OS::MemoryMappedFile* g_natives_file = nullptr;
+base::OS::MemoryMappedFile* g_snapshot_file = nullptr;
 
 
 void ClearStartupData(v8::StartupData* data) {
@@ -31,50 +33,54 @@ void ClearStartupData(v8::StartupData* data) {
 }
 
 
-void DeleteStartupData(v8::StartupData* data) {
-  delete[] data->data;
+void DeleteStartupData(v8::StartupData* data,
+                       base::OS::MemoryMappedFile** file) {
+  delete *file;
+  *file = nullptr;
   ClearStartupData(data);
 }
 
 
 void FreeStartupData() {
-  DeleteStartupData(&g_natives);
-  DeleteStartupData(&g_snapshot);
+  DeleteStartupData(&g_natives, &g_natives_file);
+  DeleteStartupData(&g_snapshot, &g_snapshot_file);
 }
 
 
+// The blobs are mapped read-only rather than read into the heap, so that their
+// pages are shared with the page cache and only the parts touched during
+// deserialization become resident.
 void Load(const char* blob_file, v8::StartupData* startup_data,
+          base::OS::MemoryMappedFile** file,
           void (*setter_fn)(v8::StartupData*)) {
   ClearStartupData(startup_data);
 
   CHECK(blob_file);
 
-  FILE* file = fopen(blob_file, "rb");
-  if (!file) {
+  *file = base::OS::MemoryMappedFile::open(
+      blob_file, base::OS::MemoryMappedFile::FileMode::kReadOnly);
+  if (*file == nullptr) {
     PrintF(stderr, "Failed to open startup resource '%s'.\n", blob_file);
     return;
   }
 
-  fseek(file, 0, SEEK_END);
-  startup_data->raw_size = static_cast<int>(ftell(file));
-  rewind(file);
-
-  startup_data->data = new char[startup_data->raw_size];
-  int read_size = static_cast<int>(fread(const_cast<char*>(startup_data->data),
-                                         1, startup_data->raw_size, file));
-  fclose(file);
-
-  if (startup_data->raw_size == read_size) {
-    (*setter_fn)(startup_data);
-  } else {
+  if ((*file)->size() == 0 || (*file)->memory() == nullptr) {
     PrintF(stderr, "Corrupted startup resource '%s'.\n", blob_file);
+    delete *file;
+    *file = nullptr;
+    return;
   }
+
+  startup_data->data = static_cast<const char*>((*file)->memory());
+  startup_data->raw_size = static_cast<int>((*file)->size());
+  (*setter_fn)(startup_data);
 }
 
 
 void LoadFromFiles(const char* natives_blob, const char* snapshot_blob) {
-  Load(natives_blob, &g_natives, v8::V8::SetNativesDataBlob);
-  Load(snapshot_blob, &g_snapshot, v8::V8::SetSnapshotDataBlob);
+  Load(natives_blob, &g_natives, &g_natives_file, v8::V8::SetNativesDataBlob);
+  Load(snapshot_blob, &g_snapshot, &g_snapshot_file,
+       v8::V8::SetSnapshotDataBlob);
 
   atexit(&FreeStartupData);
 }
@@ -1248,7 +1248,10 @@ TEST(Iteration) {
   CHECK_EQ(objs_count, ObjectsFoundInHeap(CcTest::heap(), objs, objs_count));
 }
 
-TEST(TestBytecodeFlushing) {
+// Compiles foo, checks that its bytecode survives |surviving_gcs| full GCs
+// and is flushed by the following |flushing_gcs| ones, and that calling foo
+// recompiles it.
+static void CheckBytecodeFlushing(int surviving_gcs, int flushing_gcs) {
 #ifndef V8_LITE_MODE
   FLAG_opt = false;
   FLAG_always_opt = false;
@@ -1288,14 +1291,13 @@ TEST(TestBytecodeFlushing) {
     Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
     CHECK(function->shared()->is_compiled());
 
-    // The code will survive at least two GCs.
-    CcTest::CollectAllGarbage();
-    CcTest::CollectAllGarbage();
+    for (int i = 0; i < surviving_gcs; i++) {
+      CcTest::CollectAllGarbage();
+    }
     CHECK(function->shared()->is_compiled());
 
     // Simulate several GCs that use full marking.
-    const int kAgingThreshold = 6;
-    for (int i = 0; i < kAgingThreshold; i++) {
+    for (int i = 0; i < flushing_gcs; i++) {
       CcTest::CollectAllGarbage();
     }
 
@@ -1309,6 +1311,18 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushing) {
+  // The code will survive at least two GCs.
+  const int kAgingThreshold = 6;
+  CheckBytecodeFlushing(2, kAgingThreshold);
+}
+
+TEST(TestBytecodeFlushingOldAge) {
+  // With the lowest age threshold a few GCs are enough to flush foo.
+  i::FLAG_bytecode_old_age = 1;
+  CheckBytecodeFlushing(0, 3);
+}
+
 #ifndef V8_LITE_MODE
 
 TEST(TestOptimizeAfterBytecodeFlushingCandidate) {
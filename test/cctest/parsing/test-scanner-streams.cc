@@ -166,6 +166,36 @@ TEST(Utf8StreamAsciiOnly) {
   } while (c != v8::internal::Utf16CharacterStream::kEndOfInput);
 }
 
+TEST(Utf8StreamLongAsciiRuns) {
+  // ASCII runs longer than the stream's buffer, interrupted by multi-byte
+  // characters, some of which end up at buffer boundaries.
+  std::string source;
+  std::vector<uint16_t> expected;
+  for (int i = 0; i < 2000; i++) {
+    if (i % 511 == 0) {
+      source += "\xc3\xa4";  // U+00E4, two bytes.
+      expected.push_back(0xE4);
+    } else {
+      source += static_cast<char>('a' + i % 26);
+      expected.push_back('a' + i % 26);
+    }
+  }
+  source += "\xf0\x90\x8c\x80";  // U+10300, a surrogate pair.
+  expected.push_back(0xD800);
+  expected.push_back(0xDF00);
+
+  const char* chunks[] = {source.c_str(), ""};
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+  for (uint16_t c : expected) {
+    CHECK_EQ(c, stream->Advance());
+  }
+  CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput, stream->Advance());
+}
+
 TEST(Utf8StreamMaxNonSurrogateCharCode) {
   const char* chunks[] = {"\uffff\uffff", ""};
   ChunkSource chunk_source(chunks);
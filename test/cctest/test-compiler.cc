@@ -793,6 +793,65 @@ TEST(InvocationCount) {
   CHECK_EQ(4, foo->feedback_vector()->invocation_count());
 }
 
+// Returns the number of live entries in the OSR code cache of the current
+// native context and stores the code and context key of the last one.
+static int CountLiveOsrCodeCacheEntries(Code* code, MaybeObject* context) {
+  WeakFixedArray cache =
+      CcTest::i_isolate()->native_context()->osr_code_cache();
+  int count = 0;
+  for (int entry = 0; entry < cache->length();
+       entry += Compiler::kOsrCodeCacheEntryLength) {
+    HeapObject entry_code;
+    if (!cache->Get(entry + Compiler::kOsrCodeCacheCodeOffset)
+             ->GetHeapObjectIfWeak(&entry_code)) {
+      continue;
+    }
+    if (Code::cast(entry_code)->marked_for_deoptimization()) continue;
+    *code = Code::cast(entry_code);
+    *context = cache->Get(entry + Compiler::kOsrCodeCacheContextOffset);
+    count++;
+  }
+  return count;
+}
+
+TEST(OsrCodeCacheReuse) {
+  if (!i::FLAG_opt || i::FLAG_always_opt || !i::FLAG_use_osr ||
+      i::FLAG_lite_mode) {
+    return;
+  }
+  i::FLAG_allow_natives_syntax = true;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer()) return;
+  v8::HandleScope scope(CcTest::isolate());
+
+  // {sum} is the only closure for its feedback cell, so its OSR code is
+  // specialized to the function context.
+  CompileRun(
+      "function sum(a) {"
+      "  var result = 0;"
+      "  for (var i = 0; i < a.length; i++) {"
+      "    result += a[i];"
+      "    if (i == 5) %OptimizeOsr();"
+      "  }"
+      "  return result;"
+      "}"
+      "var ints = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10];"
+      "sum(ints);");
+  Handle<JSFunction> sum = Handle<JSFunction>::cast(GetGlobalProperty("sum"));
+  Code code;
+  MaybeObject context;
+  CHECK_EQ(1, CountLiveOsrCodeCacheEntries(&code, &context));
+  CHECK(context->IsWeak());
+  CHECK(context->GetHeapObjectAssumeWeak() == sum->context());
+  Handle<Code> osr_code(code, CcTest::i_isolate());
+
+  // Entering the loop again reuses the cached code. Compiling it again would
+  // add a second live entry.
+  CompileRun("sum(ints);");
+  CHECK_EQ(1, CountLiveOsrCodeCacheEntries(&code, &context));
+  CHECK_EQ(*osr_code, code);
+}
+
 TEST(SafeToSkipArgumentsAdaptor) {
   CcTest::InitializeVM();
   v8::HandleScope scope(CcTest::isolate());
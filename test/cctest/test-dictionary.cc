@@ -239,6 +239,44 @@ TEST(HashTableRehash) {
   }
 }
 
+TEST(NameDictionaryReusesTableWithDeletedEntries) {
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(context->GetIsolate());
+  auto name = [=](int i) {
+    std::string str = "p" + std::to_string(i);
+    return factory->InternalizeUtf8String(str.c_str());
+  };
+  const int kElements = 20;
+  Handle<NameDictionary> dictionary = NameDictionary::New(isolate, kElements);
+  Handle<Object> value(Smi::kZero, isolate);
+  PropertyDetails details = PropertyDetails::Empty();
+  for (int i = 0; i < kElements; i++) {
+    dictionary =
+        NameDictionary::Add(isolate, dictionary, name(i), value, details);
+  }
+  int capacity = dictionary->Capacity();
+
+  // Repeatedly replace a property, which leaves a deleted entry behind. Once
+  // the deleted entries would force a resize, they are cleared in place.
+  for (int i = 0; i < capacity; i++) {
+    int entry = dictionary->FindEntry(isolate, name(i));
+    CHECK_NE(NameDictionary::kNotFound, entry);
+    Handle<NameDictionary> result =
+        NameDictionary::DeleteEntry(isolate, dictionary, entry);
+    CHECK_EQ(*dictionary, *result);
+    result = NameDictionary::Add(isolate, dictionary, name(i + kElements),
+                                 value, details);
+    CHECK_EQ(*dictionary, *result);
+  }
+  CHECK_EQ(capacity, dictionary->Capacity());
+  CHECK_EQ(kElements, dictionary->NumberOfElements());
+  for (int i = capacity; i < capacity + kElements; i++) {
+    CHECK_NE(NameDictionary::kNotFound,
+             dictionary->FindEntry(isolate, name(i)));
+  }
+}
 
 #ifdef DEBUG
 template<class HashSet>
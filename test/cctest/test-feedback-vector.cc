@@ -313,6 +313,38 @@ TEST(OneShotCallICSlotCount) {
   CHECK_EQ(GetFeedbackVectorLength(isolate, multiple_calls, true), 4);
 }
 
+TEST(LazyFeedbackAllocationBudget) {
+  if (i::FLAG_always_opt) return;
+  FLAG_lazy_feedback_allocation = true;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  // A single run through a function larger than the allocation budget doesn't
+  // allocate a feedback vector.
+  std::string straight_line = "function g() { var x = 0;";
+  for (int i = 0; i < FLAG_budget_for_feedback_vector_allocation; i++) {
+    straight_line += " x = x + 1;";
+  }
+  straight_line += " return x; } g();";
+  CompileRun(straight_line.c_str());
+  CHECK(!GetFunction("g")->has_feedback_vector());
+
+  // A loop exhausts the budget and allocates the feedback vector.
+  CompileRun(
+      "function f(a) {"
+      "  var s = 0;"
+      "  for (var i = 0; i < a; i++) s += i;"
+      "  return s;"
+      "}"
+      "f(1);");
+  Handle<JSFunction> f = GetFunction("f");
+  CHECK(!f->has_feedback_vector());
+  CompileRun("f(100000);");
+  CHECK(f->has_feedback_vector());
+}
+
 TEST(VectorCallCounts) {
   if (!i::FLAG_use_ic) return;
   if (i::FLAG_always_opt) return;
@@ -2465,6 +2465,58 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerPreservesPreparseData) {
+  // Lazy functions keep the preparse data collected for their inner functions
+  // across a code cache round trip, so that compiling them later in the
+  // consuming isolate can skip the inner functions without preparsing them
+  // again.
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()->Disable();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source =
+      "function outer() {"
+      "  var x = 1;"
+      "  function inner() { return x; }"
+      "  return inner;"
+      "}"
+      "typeof outer";
+
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(CStrVector(source))
+                                   .ToHandleChecked();
+
+  ScriptData* cache = nullptr;
+  CompileScriptAndProduceCache(isolate, orig_source, Handle<String>(), &cache,
+                               v8::ScriptCompiler::kNoCompileOptions);
+
+  Handle<SharedFunctionInfo> copy;
+  {
+    DisallowCompilation no_compile_expected(isolate);
+    copy = CompileScript(isolate, copy_source, Handle<String>(), cache,
+                         v8::ScriptCompiler::kConsumeCodeCache);
+  }
+
+  bool found_outer = false;
+  SharedFunctionInfo::ScriptIterator iterator(isolate,
+                                              Script::cast(copy->script()));
+  for (SharedFunctionInfo shared = iterator.Next(); !shared.is_null();
+       shared = iterator.Next()) {
+    if (!shared->Name()->IsUtf8EqualTo(CStrVector("outer"))) continue;
+    CHECK(!shared->is_compiled());
+    CHECK(shared->HasUncompiledDataWithPreparseData());
+    found_outer = true;
+  }
+  CHECK(found_outer);
+
+  delete cache;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
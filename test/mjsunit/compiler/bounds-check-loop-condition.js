@@ -0,0 +1,60 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// The bounds checks on a[i] below are dominated by the loop condition.
+
+(function TestSumLessThanLength() {
+  function sum(a) {
+    var result = 0;
+    for (var i = 0; i < a.length; i++) result += a[i];
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(15, sum([1, 2, 3, 4, 5]));
+  assertEquals(0, sum([]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(15, sum([1, 2, 3, 4, 5]));
+  assertEquals(0, sum([]));
+  assertEquals(55, sum([1, 2, 3, 4, 5, 6, 7, 8, 9, 10]));
+  assertOptimized(sum);
+})();
+
+(function TestLengthChangesInLoop() {
+  function sum(a) {
+    var result = 0;
+    for (var i = 0; i < a.length; i++) {
+      result += a[i];
+      if (i == 1) a.length = 3;
+    }
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(6, sum([1, 2, 3, 4, 5]));
+  assertEquals(6, sum([1, 2, 3, 4, 5]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(6, sum([1, 2, 3, 4, 5]));
+  assertOptimized(sum);
+})();
+
+(function TestLessThanOrEqualStillChecked() {
+  // {i <= a.length} does not imply that {i} is in bounds, so the last
+  // access must still go out of bounds.
+  function count(a) {
+    var result = 0;
+    for (var i = 0; i <= a.length; i++) {
+      if (a[i] === undefined) result++;
+    }
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(count);
+  assertEquals(1, count([1, 2, 3]));
+  assertEquals(1, count([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(count);
+  assertEquals(1, count([1, 2, 3]));
+})();
@@ -32,3 +32,21 @@
   assertEquals("first", f(0));
   assertEquals("second", f(1));
 })();
+
+// Test variable index access to array with 4 elements.
+(function testFourElementArrayVariableIndex() {
+  function f(i) {
+    const a = new Array("first", "second", "third", "fourth");
+    return a[i];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals("first", f(0));
+  assertEquals("fourth", f(3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("first", f(0));
+  assertEquals("second", f(1));
+  assertEquals("third", f(2));
+  assertEquals("fourth", f(3));
+  assertOptimized(f);
+})();
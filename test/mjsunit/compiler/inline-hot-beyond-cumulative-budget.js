@@ -0,0 +1,41 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --max-inlined-bytecode-size-cumulative=0
+// Flags: --max-inlined-bytecode-size-small=0
+
+// With the cumulative inlining budget used up from the start, only the call
+// site that is hit many times per invocation of {caller} is still inlined.
+
+var hot_inlined;
+var cold_inlined;
+
+function hot(x) {
+  // Only set if {hot} runs as part of the optimized code of {caller}.
+  hot_inlined = (%GetOptimizationStatus(hot) &
+                 V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0;
+  return x + 1;
+}
+
+function cold(x) {
+  cold_inlined = (%GetOptimizationStatus(cold) &
+                  V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0;
+  return x + 1;
+}
+
+function caller() {
+  var result = cold(0);
+  for (var i = 0; i < 20; i++) result = hot(result);
+  return result;
+}
+
+%PrepareFunctionForOptimization(caller);
+assertEquals(21, caller());
+assertEquals(21, caller());
+%OptimizeFunctionOnNextCall(caller);
+assertEquals(21, caller());
+assertOptimized(caller);
+assertTrue(hot_inlined);
+assertFalse(cold_inlined);
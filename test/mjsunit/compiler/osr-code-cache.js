@@ -0,0 +1,27 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr
+
+function sum(a) {
+  var result = 0;
+  for (var i = 0; i < a.length; i++) {
+    result += a[i];
+    if (i == 5) %OptimizeOsr();
+  }
+  return result;
+}
+
+var ints = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10];
+
+// The second and third invocations reuse the cached OSR code. The reuse
+// itself is checked by the OsrCodeCacheReuse cctest.
+assertEquals(55, sum(ints));
+assertEquals(55, sum(ints));
+assertEquals(55, sum(ints));
+
+// Deoptimizing the OSR code must not leave it in the cache.
+assertEquals("012345678910", sum(["", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10]));
+assertEquals(55, sum(ints));
+assertEquals(5.5, sum([0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5]));
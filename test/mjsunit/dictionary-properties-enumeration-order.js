@@ -0,0 +1,66 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test that keys of dictionary mode objects are enumerated in insertion
+// order, both when the enumeration indices are dense and when many
+// properties have been deleted.
+
+function MakeDictionary(n) {
+  var o = {};
+  for (var i = 0; i < n; i++) o["p" + i] = i;
+  delete o.p0;
+  o.p0 = 0;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+function ExpectedKeys(n) {
+  var keys = [];
+  for (var i = 1; i < n; i++) keys.push("p" + i);
+  keys.push("p0");
+  return keys;
+}
+
+(function TestDense() {
+  var o = MakeDictionary(20);
+  var expected = ExpectedKeys(20);
+  assertEquals(expected, Object.keys(o));
+  assertEquals(expected, Object.getOwnPropertyNames(o));
+  var actual = [];
+  for (var key in o) actual.push(key);
+  assertEquals(expected, actual);
+})();
+
+(function TestSparse() {
+  var o = MakeDictionary(100);
+  var expected = ExpectedKeys(100);
+  for (var i = 1; i < 100; i++) {
+    if (i % 3 == 0) continue;
+    delete o["p" + i];
+    expected.splice(expected.indexOf("p" + i), 1);
+  }
+  o.last = 1;
+  expected.push("last");
+  assertFalse(%HasFastProperties(o));
+  assertEquals(expected, Object.keys(o));
+  assertEquals(expected, Object.getOwnPropertyNames(o));
+  var actual = [];
+  for (var key in o) actual.push(key);
+  assertEquals(expected, actual);
+})();
+
+(function TestNonEnumerableAndSymbols() {
+  var o = MakeDictionary(10);
+  var sym = Symbol("s");
+  o[sym] = 1;
+  Object.defineProperty(o, "hidden", {value: 1, enumerable: false});
+  o.visible = 1;
+  var expected = ExpectedKeys(10);
+  assertEquals(expected.concat("visible"), Object.keys(o));
+  assertEquals(expected.concat("hidden", "visible"),
+               Object.getOwnPropertyNames(o));
+  assertEquals([sym], Object.getOwnPropertySymbols(o));
+})();
@@ -199,3 +199,28 @@ testTypedArrays.floatOnly = function (callback) {
     assertTrue(new FloatArrayConstructor([1, 2, +Infinity]).includes(+Infinity));
   });
 })();
+
+
+// %TypedArray%.prototype.includes and indexOf on byte-sized element kinds
+// search the raw backing store.
+(function() {
+  var ta = new Int8Array([1, -1, 127, -128, 0, -1]);
+  assertTrue(ta.includes(-1));
+  assertTrue(ta.includes(-128));
+  assertFalse(ta.includes(255));
+  assertFalse(ta.includes(-128, 4));
+  assertEquals(1, ta.indexOf(-1));
+  assertEquals(5, ta.indexOf(-1, 2));
+  assertEquals(-1, ta.indexOf(-1, 6));
+
+  var u8 = new Uint8Array([0, 255, 7, 255]);
+  assertTrue(u8.includes(255));
+  assertFalse(u8.includes(-1));
+  assertFalse(u8.includes(7.5));
+  assertEquals(3, u8.indexOf(255, 2));
+
+  var clamped = new Uint8ClampedArray([300, -5, 12]);
+  assertTrue(clamped.includes(255));
+  assertTrue(clamped.includes(0));
+  assertEquals(2, clamped.indexOf(12));
+})();
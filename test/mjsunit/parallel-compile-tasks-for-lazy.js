@@ -0,0 +1,53 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --parallel-compile-tasks-for-lazy
+// Flags: --use-external-strings
+
+var outer_var = 42;
+
+function lazy_outer() {
+  return outer_var;
+}
+
+function lazy_with_inner(a) {
+  function inner() { return a + outer_var; }
+  return inner();
+}
+
+function* lazy_generator() {
+  yield 1;
+  yield 2;
+}
+
+async function lazy_async() {
+  return outer_var;
+}
+
+class LazyClass {
+  constructor(x) { this.x = x; }
+  get value() { return this.x; }
+}
+
+var lazy_arrow = (a, ...rest) => a + rest.length;
+
+assertEquals(42, lazy_outer());
+assertEquals(43, lazy_with_inner(1));
+
+var gen = lazy_generator();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+
+var async_result;
+lazy_async().then(v => async_result = v);
+%PerformMicrotaskCheckpoint();
+assertEquals(42, async_result);
+
+assertEquals(7, new LazyClass(7).value);
+assertEquals(3, lazy_arrow(1, 2, 3));
+
+// Never called, so only compiled if the parser hands it off.
+function never_called() {
+  return outer_var;
+}
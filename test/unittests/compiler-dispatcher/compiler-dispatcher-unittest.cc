@@ -798,6 +798,46 @@ TEST_F(CompilerDispatcherTest, CompileLazy2FinishesDispatcherJob) {
   ASSERT_FALSE(dispatcher->IsEnqueued(shared_2));
 }
 
+// Parses {raw_source} as a top-level script and returns the number of
+// functions the parser handed to the isolate's compiler dispatcher.
+static int CountParallelCompileTasks(Isolate* isolate, const char* raw_source) {
+  test::ScriptResource* source =
+      new test::ScriptResource(raw_source, strlen(raw_source));
+  Handle<Script> script =
+      isolate->factory()->NewScript(test::CreateSource(isolate, source));
+  ParseInfo parse_info(isolate, script);
+  CHECK(parsing::ParseProgram(&parse_info, isolate));
+  CHECK_NOT_NULL(parse_info.parallel_tasks());
+  int count = 0;
+  for (auto it = parse_info.parallel_tasks()->begin();
+       it != parse_info.parallel_tasks()->end(); ++it) {
+    count++;
+  }
+  isolate->compiler_dispatcher()->AbortAll();
+  return count;
+}
+
+TEST_F(CompilerDispatcherTest, ParallelCompileTasksForLazyTopLevelFunctions) {
+  bool old_parallel_compile_tasks = FLAG_parallel_compile_tasks;
+  bool old_parallel_compile_tasks_for_lazy =
+      FLAG_parallel_compile_tasks_for_lazy;
+  FLAG_parallel_compile_tasks = true;
+
+  const char raw_source[] =
+      "function lazy() { return 42; };"
+      "(function eager() { return 42; })();";
+
+  // Only the eagerly compiled function is handed off by default.
+  FLAG_parallel_compile_tasks_for_lazy = false;
+  ASSERT_EQ(1, CountParallelCompileTasks(i_isolate(), raw_source));
+
+  FLAG_parallel_compile_tasks_for_lazy = true;
+  ASSERT_EQ(2, CountParallelCompileTasks(i_isolate(), raw_source));
+
+  FLAG_parallel_compile_tasks = old_parallel_compile_tasks;
+  FLAG_parallel_compile_tasks_for_lazy = old_parallel_compile_tasks_for_lazy;
+}
+
 TEST_F(CompilerDispatcherTest, CompileMultipleOnBackgroundThread) {
   MockPlatform platform;
   CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
@@ -6,6 +6,7 @@
 #include "src/compiler/js-graph.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/compiler-test-utils.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
@@ -19,9 +20,11 @@ class BranchEliminationTest : public GraphTest {
  public:
   BranchEliminationTest()
       : machine_(zone(), MachineType::PointerRepresentation(),
-                 MachineOperatorBuilder::kNoFlags) {}
+                 MachineOperatorBuilder::kNoFlags),
+        simplified_(zone()) {}
 
   MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
 
   void Reduce() {
     JSOperatorBuilder javascript(zone());
@@ -36,6 +39,7 @@ class BranchEliminationTest : public GraphTest {
 
  private:
   MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
 };
 
 
@@ -208,6 +212,45 @@ TEST_F(BranchEliminationTest, BranchInsideLoopSame) {
   EXPECT_THAT(ret1, IsReturn(IsInt32Constant(2), effect, loop));
 }
 
+TEST_F(BranchEliminationTest, CheckBoundsDominatedByLessThan) {
+  // { if (i < length) return a[i]; else return a[i]; }
+  // The bounds check in the true branch is implied by the condition, the one
+  // in the false branch is not.
+  Node* index = Parameter(Type::Unsigned31(), 0);
+  Node* length = Parameter(Type::Unsigned31(), 1);
+  Node* condition =
+      graph()->NewNode(simplified()->NumberLessThan(), index, length);
+  Node* branch = graph()->NewNode(
+      common()->Branch(BranchHint::kNone, IsSafetyCheck::kNoSafetyCheck),
+      condition, graph()->start());
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check_true =
+      graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()), index,
+                       length, graph()->start(), if_true);
+  NodeProperties::SetType(check_true, Type::Unsigned31());
+  Node* ret_true = graph()->NewNode(common()->Return(), zero, check_true,
+                                    check_true, if_true);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* check_false =
+      graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()), index,
+                       length, graph()->start(), if_false);
+  NodeProperties::SetType(check_false, Type::Unsigned31());
+  Node* ret_false = graph()->NewNode(common()->Return(), zero, check_false,
+                                     check_false, if_false);
+
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret_true, ret_false));
+
+  Reduce();
+
+  EXPECT_THAT(check_true, IsTypeGuard(index, if_true));
+  EXPECT_EQ(IrOpcode::kCheckBounds, check_false->opcode());
+  EXPECT_EQ(IsSafetyCheck::kCriticalSafetyCheck,
+            IsSafetyCheckOf(branch->op()));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
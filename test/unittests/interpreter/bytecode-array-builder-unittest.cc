@@ -278,7 +278,8 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
       .ThrowSuperAlreadyCalledIfNotHole()
       .ThrowSuperNotCalledIfHole();
 
-  // Short jumps with Imm8 operands
+  // Short jumps with Imm8 operands. Each label is bound after the next jump,
+  // since jumps to the immediately following bytecode are elided.
   {
     BytecodeLoopHeader loop_header;
     BytecodeLabel after_jump1, after_jump2, after_jump3, after_jump4,
@@ -286,25 +287,25 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
         after_jump10, after_loop;
     builder.JumpIfNull(&after_loop)
         .Bind(&loop_header)
-        .Jump(&after_jump1)
+        .JumpIfNull(&after_jump1)
+        .Jump(&after_jump2)
         .Bind(&after_jump1)
-        .JumpIfNull(&after_jump2)
-        .Bind(&after_jump2)
         .JumpIfNotNull(&after_jump3)
-        .Bind(&after_jump3)
+        .Bind(&after_jump2)
         .JumpIfUndefined(&after_jump4)
-        .Bind(&after_jump4)
+        .Bind(&after_jump3)
         .JumpIfNotUndefined(&after_jump5)
-        .Bind(&after_jump5)
+        .Bind(&after_jump4)
         .JumpIfJSReceiver(&after_jump6)
-        .Bind(&after_jump6)
+        .Bind(&after_jump5)
         .JumpIfTrue(ToBooleanMode::kConvertToBoolean, &after_jump7)
-        .Bind(&after_jump7)
+        .Bind(&after_jump6)
         .JumpIfTrue(ToBooleanMode::kAlreadyBoolean, &after_jump8)
-        .Bind(&after_jump8)
+        .Bind(&after_jump7)
         .JumpIfFalse(ToBooleanMode::kConvertToBoolean, &after_jump9)
-        .Bind(&after_jump9)
+        .Bind(&after_jump8)
         .JumpIfFalse(ToBooleanMode::kAlreadyBoolean, &after_jump10)
+        .Bind(&after_jump9)
         .Bind(&after_jump10)
         .JumpLoop(&loop_header, 0)
         .Bind(&after_loop);
@@ -302,7 +302,9 @@ TEST_F(BytecodeArrayWriterUnittest, ElideNoneffectfulBytecodes) {
 }
 
 TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
-  static const uint8_t expected_bytes[] = {
+  // The jump over dead code becomes a jump to the next bytecode, which is only
+  // elided along with the other non-effectful bytecodes.
+  static const uint8_t expected_bytes_with_jump[] = {
       // clang-format off
       /*  0  10 E> */ B(StackCheck),
       /*  1  55 S> */ B(LdaSmi), U8(127),
@@ -318,9 +320,40 @@ TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
       // clang-format on
   };
 
-  static const PositionTableEntry expected_positions[] = {
+  static const PositionTableEntry expected_positions_with_jump[] = {
       {0, 10, false}, {1, 55, true}, {5, 65, true}, {9, 75, true}};
 
+  static const uint8_t expected_bytes_without_jump[] = {
+      // clang-format off
+      /*  0  10 E> */ B(StackCheck),
+      /*  1  55 S> */ B(LdaSmi), U8(127),
+      /*  3  65 S> */ B(LdaSmi), U8(127),
+      /*  5        */ B(JumpIfFalse), U8(3),
+      /*  7  75 S> */ B(Return),
+      /*  8        */ B(JumpIfFalse), U8(3),
+      /*  10       */ B(Throw),
+      /*  11       */ B(JumpIfFalse), U8(3),
+      /*  13       */ B(ReThrow),
+      /*  14       */ B(Return),
+      // clang-format on
+  };
+
+  static const PositionTableEntry expected_positions_without_jump[] = {
+      {0, 10, false}, {1, 55, true}, {3, 65, true}, {7, 75, true}};
+
+  const bool jump_elided = i::FLAG_ignition_elide_noneffectful_bytecodes;
+  const uint8_t* expected_bytes =
+      jump_elided ? expected_bytes_without_jump : expected_bytes_with_jump;
+  size_t expected_bytes_size = jump_elided
+                                   ? arraysize(expected_bytes_without_jump)
+                                   : arraysize(expected_bytes_with_jump);
+  const PositionTableEntry* expected_positions =
+      jump_elided ? expected_positions_without_jump
+                  : expected_positions_with_jump;
+  size_t expected_positions_size =
+      jump_elided ? arraysize(expected_positions_without_jump)
+                  : arraysize(expected_positions_with_jump);
+
   BytecodeLabel after_jump, after_conditional_jump, after_return, after_throw,
       after_rethrow;
 
@@ -348,6 +381,56 @@ TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   writer()->BindLabel(&after_rethrow);
   Write(Bytecode::kReturn);
 
+  CHECK_EQ(bytecodes()->size(), expected_bytes_size);
+  for (size_t i = 0; i < expected_bytes_size; ++i) {
+    CHECK_EQ(static_cast<int>(bytecodes()->at(i)),
+             static_cast<int>(expected_bytes[i]));
+  }
+
+  Handle<BytecodeArray> bytecode_array =
+      writer()->ToBytecodeArray(isolate(), 0, 0, factory()->empty_byte_array());
+  SourcePositionTableIterator source_iterator(
+      bytecode_array->SourcePositionTable());
+  for (size_t i = 0; i < expected_positions_size; ++i) {
+    const PositionTableEntry& expected = expected_positions[i];
+    CHECK_EQ(source_iterator.code_offset(), expected.code_offset);
+    CHECK_EQ(source_iterator.source_position().ScriptOffset(),
+             expected.source_position);
+    CHECK_EQ(source_iterator.is_statement(), expected.is_statement);
+    source_iterator.Advance();
+  }
+  CHECK(source_iterator.done());
+}
+
+TEST_F(BytecodeArrayWriterUnittest, ElideJumpToNextBytecode) {
+  if (!i::FLAG_ignition_elide_noneffectful_bytecodes) return;
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0  10 E> */ B(StackCheck),
+      /*  1        */ B(LdaZero),
+      /*  2  30 S> */ B(Jump), U8(2),
+      /*  4        */ B(Return),
+      // clang-format on
+  };
+
+  static const PositionTableEntry expected_positions[] = {{0, 10, false},
+                                                          {2, 30, true}};
+
+  BytecodeLabel elided_jump, elided_conditional_jump, kept_jump;
+
+  Write(Bytecode::kStackCheck, {10, false});
+  Write(Bytecode::kLdaZero);
+  WriteJump(Bytecode::kJumpIfFalse, &elided_conditional_jump);
+  writer()->BindLabel(&elided_conditional_jump);
+  WriteJump(Bytecode::kJump, &elided_jump);
+  writer()->BindLabel(&elided_jump);
+  // Jumps with a source position are kept, so that the debugger can break on
+  // them.
+  WriteJump(Bytecode::kJump, &kept_jump, {30, true});
+  writer()->BindLabel(&kept_jump);
+  Write(Bytecode::kReturn);
+
   CHECK_EQ(bytecodes()->size(), arraysize(expected_bytes));
   for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
     CHECK_EQ(static_cast<int>(bytecodes()->at(i)),
@@ -356,6 +439,7 @@ TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
 
   Handle<BytecodeArray> bytecode_array =
       writer()->ToBytecodeArray(isolate(), 0, 0, factory()->empty_byte_array());
+  CHECK_EQ(0, bytecode_array->constant_pool()->length());
   SourcePositionTableIterator source_iterator(
       bytecode_array->SourcePositionTable());
   for (size_t i = 0; i < arraysize(expected_positions); ++i) {
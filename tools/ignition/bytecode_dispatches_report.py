@@ -47,6 +47,10 @@ examples:
 
   # Display the top 5 sources and destinations of dispatches to/from LdaZero
   $ tools/ignition/bytecode_dispatches_report.py -f LdaZero -n 5
+
+  # Print the 20 bytecodes which are most often followed by a Star, i.e. the
+  # best candidates for Bytecodes::IsStarLookahead
+  $ tools/ignition/bytecode_dispatches_report.py -l -n 20
 """
 
 __COUNTER_BITS = struct.calcsize("P") * 8  # Size in bits of a pointer
@@ -128,6 +132,26 @@ def print_top_dispatch_sources_and_destinations(dispatches_table, bytecode,
     print("{:>12d}\t{:>5.1f}%\t{}".format(counter, ratio * 100, destination_name))
 
 
+def find_top_star_lookahead_candidates(dispatches_table, top_count):
+  candidates = []
+  for source, destinations in iteritems(dispatches_table):
+    if source == "Star" or "Star" not in destinations:
+      continue
+    total = float(sum(itervalues(destinations)))
+    count = destinations["Star"]
+    candidates.append((source, count, count / total))
+
+  return heapq.nlargest(top_count, candidates, key=lambda x: x[1])
+
+
+def print_top_star_lookahead_candidates(dispatches_table, top_count):
+  top_candidates = find_top_star_lookahead_candidates(dispatches_table,
+                                                      top_count)
+  print("Top {} bytecodes dispatching to Star:".format(top_count))
+  for source_name, counter, ratio in top_candidates:
+    print("{:>12d}\t{:>5.1f}%\t{}".format(counter, ratio * 100, source_name))
+
+
 def build_counters_matrix(dispatches_table):
   labels = sorted(dispatches_table.keys())
 
@@ -207,12 +231,17 @@ def parse_command_line():
     action="store_true",
     help="print the top bytecode dispatch pairs"
   )
+  command_line_parser.add_argument(
+    "--top-star-lookahead-candidates", "-l",
+    action="store_true",
+    help="print the bytecodes which are most often followed by a Star"
+  )
   command_line_parser.add_argument(
     "--top-entries-count", "-n",
     metavar="N",
     type=int,
     default=10,
-    help="print N top entries when running with -t or -f (default 10)"
+    help="print N top entries when running with -t, -l or -f (default 10)"
   )
   command_line_parser.add_argument(
     "--top-dispatches-for-bytecode", "-f",
@@ -272,6 +301,9 @@ def main():
   elif program_options.top_bytecode_dispatch_pairs:
     print_top_bytecode_dispatch_pairs(
       dispatches_table, program_options.top_entries_count)
+  elif program_options.top_star_lookahead_candidates:
+    print_top_star_lookahead_candidates(
+      dispatches_table, program_options.top_entries_count)
   elif program_options.top_dispatches_for_bytecode:
     print_top_dispatch_sources_and_destinations(
       dispatches_table, program_options.top_dispatches_for_bytecode,
@@ -60,3 +60,14 @@ class BytecodeDispatchesReportTest(unittest.TestCase):
       ("a", 2, 0.2),
       ("c", 10, 0.1)
     ])
+
+  def test_find_top_star_lookahead_candidates(self):
+    top_candidates = bdr.find_top_star_lookahead_candidates({
+      "Star": {"Star": 99, "a": 1},
+      "a": {"Star": 6, "b": 4},
+      "b": {"a": 1, "c": 4},
+      "c": {"Star": 30, "c": 70}}, 10)
+    self.assertListEqual(top_candidates, [
+      ("c", 30, 0.3),
+      ("a", 6, 0.6)
+    ])